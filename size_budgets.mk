@@ -0,0 +1,16 @@
+# Size budgets checked by 'make size-report' (bytes).  Regenerate with
+# 'make size-baseline' on a machine with the avr toolchain and commit the result.
+#
+# Per-object RAM costs follow from the avr-gcc data layout (2-byte pointers,
+# 1-byte alignment, no padding):
+#   Coroutine       start_fn_ + context_ + group_            = 2 + 2 + 2
+#   BasicCoroutine  Coroutine + function pointer callable    = 6 + 2
+#   Event           waiter_ + set_                           = 2 + 1
+#   TaskGroup       joiner_ + live_ (plus 2 per member)      = 2 + 1
+#
+# Library and example flash/SRAM budgets have not been measured yet and are
+# reported without a limit until 'make size-baseline' records them.
+SIZE_BUDGET_COROUTINE ?= 6
+SIZE_BUDGET_BASIC_COROUTINE_OVERHEAD ?= 8
+SIZE_BUDGET_EVENT ?= 3
+SIZE_BUDGET_TASK_GROUP_BASE ?= 3
@@ -61,19 +61,29 @@ YieldResult yield_fast_to(Coroutine& coro) {
 	}
 	jmp_buf context;
 	auto save = Coroutine::currently_running;
+	// Whomever resumed us; restored if 'coro' terminates and jumps back here.
+	jmp_buf* resumer = save->context_;
 	Coroutine::currently_running->context_ = &context;
 	switch(setjmp(context)) {
 	default:
-		assert("Bad yield result");
+		assert(!"Bad yield result");
 	case static_cast<int>(YieldResult::Continue):
+		Coroutine::currently_running = save;
 		return YieldResult::Continue;
 	case static_cast<int>(YieldResult::Terminate):
+		Coroutine::currently_running = save;
 		return YieldResult::Terminate;
 	case static_cast<int>(YieldResult::Terminated):
+		Coroutine::currently_running = save;
+		save->context_ = resumer;
+		if(detail::wake_joiner(coro) == YieldResult::Terminate) {
+			return YieldResult::Terminate;
+		}
 		return YieldResult::Terminated;
 	case 0: {
 		auto* resume_context = coro.context_;
 		coro.context_ = &context;
+		Coroutine::currently_running = &coro;
 		longjmp(*(resume_context), static_cast<int>(YieldResult::Continue));
 	}
 	}
@@ -86,24 +96,181 @@ YieldResult yield_to(Coroutine& coro) {
 	return yield_fast_to(coro);
 }
 
-void terminate(Coroutine& coro) {
+YieldResult terminate(Coroutine& coro) {
 	assert(&coro != Coroutine::currently_running);
+	if(coro.is_done()) {
+		return YieldResult::Terminated;
+	}
 	jmp_buf context;
 	auto save = Coroutine::currently_running;
+	// Whomever resumed us; restored if 'coro' terminates and jumps back here.
+	jmp_buf* resumer = save->context_;
 	Coroutine::currently_running->context_ = &context;
 	switch(setjmp(context)) {
 	default:
 		assert(!"Bad terminate() call.  Coroutine ignored termination request.");
 	case static_cast<int>(YieldResult::Terminated):
-		break;
+		Coroutine::currently_running = save;
+		save->context_ = resumer;
+		if(detail::wake_joiner(coro) == YieldResult::Terminate) {
+			return YieldResult::Terminate;
+		}
+		return YieldResult::Terminated;
 	case 0: {
 		auto* term_ctx = coro.context_;
 		coro.context_ = &context;
+		Coroutine::currently_running = &coro;
 		longjmp(*term_ctx, static_cast<int>(YieldResult::Terminate));
 	}
 	}
 }
 
+namespace detail {
+
+void finish_coroutine() {
+	Coroutine* self = Coroutine::currently_running;
+	// Note that the caller in this case is whomever last resumed this coroutine.
+	jmp_buf* caller_ctx = self->context_;
+	assert(caller_ctx and "Coroutine terminated with no caller context to yield to.");
+	self->context_ = nullptr;
+	if(self->group_) {
+		assert(self->group_->live_ and "TaskGroup member terminated more times than it was started.");
+		--self->group_->live_;
+	}
+	// Jump back to whomever last resumed this coroutine.  If this emptied a
+	// joined TaskGroup, they wake the joiner before reporting 'Terminated'.
+	longjmp(*caller_ctx, static_cast<int>(YieldResult::Terminated));
+}
+
+YieldResult wake_joiner(Coroutine& member) {
+	TaskGroupBase* group = member.group_;
+	if((not group) or group->live_ or (not group->joiner_)) {
+		return YieldResult::Continue;
+	}
+	Coroutine* joiner = group->joiner_;
+	group->joiner_ = nullptr;
+	// If the joiner resumed 'member' itself, this doesn't yield; join() just
+	// sees that the group is empty.
+	return yield_to(*joiner);
+}
+
+YieldResult TaskGroupBase::wait_for_members(Coroutine& next) {
+	assert(&next != Coroutine::currently_running and "Cannot join by yielding to the currently-running coroutine.");
+	assert((not this->joiner_) and "Only one coroutine may join a TaskGroup at a time.");
+	YieldResult signal = YieldResult::Continue;
+	this->joiner_ = Coroutine::currently_running;
+	// Whoever sees the last member terminate resumes us; anybody else
+	// resuming us just gets yielded back to 'next'.
+	while(this->live_) {
+		signal = yield_to(next);
+		if(signal != YieldResult::Continue) {
+			break;
+		}
+	}
+	this->joiner_ = nullptr;
+	if((signal == YieldResult::Terminated) and (not this->live_)) {
+		// 'next' was the last member and we saw it terminate ourselves.
+		signal = YieldResult::Continue;
+	}
+	return signal;
+}
+
+/**
+ * Wait descriptor living on the stack of a coroutine that is blocked in
+ * 'wait_for()'.  Each event being waited on points back to it.
+ */
+struct WaitList {
+	/** True if the wait can complete with the events' current state. */
+	bool satisfied() const {
+		for(uint8_t i = 0u; i < count; ++i) {
+			if(events[i]->is_set()) {
+				if(not all) {
+					return true;
+				}
+			} else if(all) {
+				return false;
+			}
+		}
+		return all;
+	}
+
+	/** Position of 'event' in the list of waited-on events. */
+	uint8_t index_of(const Event* event) const {
+		for(uint8_t i = 0u; i < count; ++i) {
+			if(events[i] == event) {
+				return i;
+			}
+		}
+		assert(!"Event is not part of this wait list.");
+		return WaitResult::none;
+	}
+
+	Coroutine* waiter;
+	Event* const* events;
+	uint8_t count;
+	bool all;
+	uint8_t fired;
+};
+
+WaitResult wait_for(Coroutine& next, Event* const* events, uint8_t count, bool all) {
+	assert(count > 0u);
+	assert(&next != Coroutine::currently_running and "Cannot wait by yielding to the currently-running coroutine.");
+	for(uint8_t i = 0u; i < count; ++i) {
+		assert((not events[i]->waiter_) and "Only one coroutine may wait on an Event at a time.");
+	}
+	WaitList list{Coroutine::currently_running, events, count, all, WaitResult::none};
+	YieldResult signal = YieldResult::Continue;
+	if(list.satisfied()) {
+		// Nothing to wait for.
+		if(all) {
+			list.fired = count - 1u;
+		} else {
+			for(list.fired = 0u; not events[list.fired]->is_set(); ++list.fired) {
+				(void)0;
+			}
+		}
+	} else {
+		for(uint8_t i = 0u; i < count; ++i) {
+			events[i]->waiter_ = &list;
+		}
+		// Stay suspended until an Event::set() call completes the wait.  Anybody
+		// else resuming us just gets yielded back to 'next'.
+		while(list.fired == WaitResult::none) {
+			signal = yield_to(next);
+			if(signal != YieldResult::Continue) {
+				break;
+			}
+		}
+		for(uint8_t i = 0u; i < count; ++i) {
+			events[i]->waiter_ = nullptr;
+		}
+	}
+	if(signal != YieldResult::Continue) {
+		return WaitResult{signal, WaitResult::none};
+	}
+	// Consume the event(s) that completed the wait.
+	if(all) {
+		for(uint8_t i = 0u; i < count; ++i) {
+			events[i]->clear();
+		}
+	} else {
+		events[list.fired]->clear();
+	}
+	return WaitResult{YieldResult::Continue, list.fired};
+}
+
+} /* namespace detail */
+
+YieldResult Event::set() {
+	this->set_ = true;
+	detail::WaitList* list = this->waiter_;
+	if((not list) or (not list->satisfied())) {
+		return YieldResult::Continue;
+	}
+	// Hand off directly to the waiter so it never has to poll.
+	list->fired = list->index_of(this);
+	return yield_to(*list->waiter);
+}
 
 } /* namespace ino::coro */
 
@@ -47,14 +47,45 @@ YieldResult yield_to(Coroutine& coro);
  * Send a 'Terminate' signal to the coroutine.  After calling
  * terminate on a coroutine object, the coroutine must be 'start()'ed
  * again before resuming it.
+ * Returns 'Terminated', or 'Terminate' if the caller was itself sent a
+ * 'Terminate' signal while the joiner of the coroutine's TaskGroup ran.
  */
-void terminate(Coroutine& coro);
+YieldResult terminate(Coroutine& coro);
+
+struct Event;
+struct WaitResult;
 
 namespace detail {
 
+struct WaitList;
+
+/**
+ * Suspend the currently-running coroutine until one (or, if 'all' is true,
+ * every one) of the 'count' events in 'events' has been set.  Control is
+ * yielded to 'next' while waiting.
+ */
+[[nodiscard]]
+WaitResult wait_for(Coroutine& next, Event* const* events, uint8_t count, bool all);
+
 template <class Callable>
 void start_coroutine(Coroutine* caller, Callable* callable);
 
+/**
+ * Exit path for all coroutines besides main.  Marks the currently-running
+ * coroutine as done and jumps back to whomever last resumed it.
+ */
+[[noreturn]]
+void finish_coroutine();
+
+/**
+ * Called by whomever observes 'member' terminate.  If that left the member's
+ * TaskGroup empty while a coroutine is joining it, yield to the joiner.
+ * Returns the result of that yield, or 'Continue' if there was no yield.
+ */
+YieldResult wake_joiner(Coroutine& member);
+
+struct TaskGroupBase;
+
 [[noreturn]]
 void coro_start(
 	uint16_t coroutine_addr,
@@ -84,8 +115,8 @@ struct Coroutine {
 	/** True if this coroutine must be started before resuming. */
 	bool is_done() const;
 
-	/** Terminate the coroutine if it is running. */
-	void end() { terminate(*this); }
+	/** Terminate the coroutine if it is running.  See 'terminate()'. */
+	YieldResult end() { return terminate(*this); }
 
 	/**
 	 * Start the coroutine.
@@ -94,15 +125,13 @@ struct Coroutine {
 	 * object is not invoked until the first time this coroutine
 	 * is resumed.
 	 */
-	void begin() {
-		assert(this->start_fn_);
-		this->start_fn_(*this);
-	}
+	void begin();
 protected:
 
 	Coroutine(void (*start_fn)(Coroutine&)):
 		start_fn_(start_fn),
-		context_(nullptr)
+		context_(nullptr),
+		group_(nullptr)
 	{
 		
 	}
@@ -144,7 +173,11 @@ protected:
 
 	friend [[nodiscard]] YieldResult yield_fast_to(Coroutine&);
 	friend [[nodiscard]] YieldResult yield_to(Coroutine&);
-	friend void terminate(Coroutine&);
+	friend YieldResult terminate(Coroutine&);
+	friend WaitResult detail::wait_for(Coroutine&, Event* const*, uint8_t, bool);
+	friend void detail::finish_coroutine();
+	friend YieldResult detail::wake_joiner(Coroutine&);
+	friend struct detail::TaskGroupBase;
 
 protected:
 	/**
@@ -157,6 +190,10 @@ protected:
 	 * Otherwise 'context_' holds the context needed to resume the coroutine.
 	 */
 	jmp_buf* context_ = nullptr;
+	/**
+	 * TaskGroup this coroutine is a member of, if any.
+	 */
+	detail::TaskGroupBase* group_ = nullptr;
 };
 
 
@@ -181,12 +218,7 @@ void start_coroutine(Coroutine* caller, Callable* callable) {
 		(void)0;
 	}
 	// The coroutine has finished executing, clean up and then jump to the caller.
-	// Note that the caller in this case is whomever lsat resumed this coroutine.  
-	jmp_buf* caller_ctx = Coroutine::currently_running->context_;
-	assert(caller_ctx and "Coroutine terminated with no caller context to yield to.");
-	Coroutine::currently_running->context_ = nullptr;
-	// Jump back to whomever last resumed this coroutine.
-	longjmp(*caller_ctx, static_cast<int>(YieldResult::Terminated));
+	finish_coroutine();
 }
 
 } /* namespace detail */
@@ -241,7 +273,7 @@ struct BasicCoroutine: Coroutine {
 
 private:
 	void start_coroutine() {
-		assert(this->context_);
+		assert(not this->context_);
 		this->initialize(callable_, &stack_[StackSz - 1u]);
 	}
 
@@ -269,6 +301,253 @@ BasicCoroutine(void (Coroutine&), stack_size<StackSz>) -> BasicCoroutine<void (*
 
 BasicCoroutine(void (Coroutine&)) -> BasicCoroutine<void (*)(Coroutine&), 128u>;
 
+namespace detail {
+
+/**
+ * Non-template part of TaskGroup.  Tracks how many members are still alive
+ * and which coroutine, if any, is suspended in 'join()'.
+ */
+struct TaskGroupBase {
+
+	TaskGroupBase(const TaskGroupBase&) = delete;
+	TaskGroupBase(TaskGroupBase&&) = delete;
+
+	TaskGroupBase& operator=(const TaskGroupBase&) = delete;
+	TaskGroupBase& operator=(TaskGroupBase&&) = delete;
+
+	/** Number of members that have been started and have not yet terminated. */
+	uint8_t live() const { return this->live_; }
+
+protected:
+	TaskGroupBase() = default;
+
+	void adopt(Coroutine& coro) {
+		assert((not coro.group_) and "A coroutine can only be a member of one TaskGroup!");
+		coro.group_ = this;
+		if(not coro.is_done()) {
+			++this->live_;
+		}
+	}
+
+	void release(Coroutine& coro) {
+		if(not coro.is_done()) {
+			--this->live_;
+		}
+		coro.group_ = nullptr;
+	}
+
+	/**
+	 * Suspend the currently-running coroutine, yielding to 'next', until the
+	 * last live member terminates.
+	 */
+	[[nodiscard]]
+	YieldResult wait_for_members(Coroutine& next);
+
+	friend struct tim::coro::Coroutine;
+	friend void detail::finish_coroutine();
+	friend YieldResult detail::wake_joiner(Coroutine&);
+
+	/** Coroutine suspended in 'join()', if any. */
+	Coroutine* joiner_ = nullptr;
+	/**
+	 * Number of members that have been started and have not yet terminated.
+	 * Counted by 'Coroutine::begin()' and 'detail::finish_coroutine()', so
+	 * members may also be started individually.
+	 */
+	uint8_t live_ = 0u;
+};
+
+} /* namespace detail */
+
+inline void Coroutine::begin() {
+	assert(this->start_fn_);
+	this->start_fn_(*this);
+	if(this->group_) {
+		++this->group_->live_;
+	}
+}
+
+/**
+ * Fixed set of 'N' coroutines that are started, joined, and torn down
+ * together.  The group only refers to its members; it does not manage
+ * their storage.
+ */
+template <size_t N>
+struct TaskGroup: detail::TaskGroupBase {
+	static_assert(N != 0u, "TaskGroup cannot be empty.");
+	static_assert(N < 256u, "TaskGroup supports at most 255 members.");
+
+	/** Create a group from all of its members. */
+	template <class ... Tasks>
+	TaskGroup(Tasks& ... tasks):
+		tasks_{&tasks ...}
+	{
+		static_assert(sizeof...(Tasks) == N);
+		for(Coroutine* coro: tasks_) {
+			this->adopt(*coro);
+		}
+	}
+
+	~TaskGroup() {
+		(void)this->cancel();
+		for(Coroutine* coro: tasks_) {
+			this->release(*coro);
+		}
+	}
+
+	/**
+	 * Start every member that is not already running, e.g. to respawn the
+	 * group after 'cancel()'.
+	 */
+	void begin() {
+		for(Coroutine* coro: tasks_) {
+			if(coro->is_done()) {
+				coro->begin();
+			}
+		}
+	}
+
+	/**
+	 * Suspend the calling coroutine, yielding to 'next', until every member
+	 * has terminated.  Whoever observes the last member terminate yields to
+	 * the caller; other resumptions just yield back to 'next'.
+	 * Returns 'Continue' once the group is done, 'Terminate' if the caller
+	 * was ended while joining (the group is cancelled first), or 'Terminated'
+	 * if 'next' terminated while other members are still live.
+	 */
+	[[nodiscard]]
+	YieldResult join(Coroutine& next) {
+		YieldResult signal = this->wait_for_members(next);
+		if(signal == YieldResult::Terminate) {
+			(void)this->cancel();
+		}
+		return signal;
+	}
+
+	/**
+	 * Send a 'Terminate' signal to every member that was live on entry, in
+	 * one pass.  Terminating the last one resumes the joiner, if any; members
+	 * it respawns are left alone.  Must not be called from a member.
+	 * Returns 'Terminate' if the caller was sent a 'Terminate' signal while
+	 * the joiner ran, otherwise 'Continue'.
+	 */
+	YieldResult cancel() {
+		YieldResult signal = YieldResult::Continue;
+		uint8_t remaining = this->live_;
+		for(Coroutine* coro: tasks_) {
+			if(not remaining) {
+				break;
+			}
+			if(coro->is_done()) {
+				continue;
+			}
+			--remaining;
+			if(terminate(*coro) == YieldResult::Terminate) {
+				signal = YieldResult::Terminate;
+			}
+		}
+		return signal;
+	}
+
+private:
+	Coroutine* tasks_[N];
+};
+
+template <class ... Tasks>
+TaskGroup(Tasks& ...) -> TaskGroup<(sizeof...(Tasks))>;
+
+/**
+ * Result of a call to 'wait_any()' or 'wait_all()'.
+ */
+struct WaitResult {
+	/** Value of 'index' when no event fired (e.g. the waiter was terminated). */
+	static constexpr uint8_t none = 0xFFu;
+
+	/**
+	 * 'Continue' if the wait completed normally.  Otherwise the signal that
+	 * interrupted the wait ('Terminate' if the waiting coroutine was ended).
+	 */
+	YieldResult signal;
+	/**
+	 * Position, in the argument list, of the event that completed the wait,
+	 * or 'none' if the wait was interrupted.
+	 */
+	uint8_t index;
+};
+
+/**
+ * Auto-reset event that at most one coroutine can wait on at a time.
+ * Events are 'set()' by one coroutine and consumed by another coroutine
+ * that waits on them with 'wait_any()' or 'wait_all()'.
+ */
+struct Event {
+
+	Event() = default;
+
+	Event(const Event&) = delete;
+	Event(Event&&) = delete;
+
+	Event& operator=(const Event&) = delete;
+	Event& operator=(Event&&) = delete;
+
+	~Event() {
+		assert((not this->waiter_) and "Event destroyed while a coroutine is waiting on it!");
+	}
+
+	/** True if this event has been set and not yet consumed. */
+	bool is_set() const { return this->set_; }
+
+	/** Reset the event without waking anyone. */
+	void clear() { this->set_ = false; }
+
+	/**
+	 * Set the event.  If this completes the wait of the coroutine waiting on
+	 * this event, the calling coroutine is suspended and the waiter is resumed
+	 * immediately.  The result of that yield is returned; otherwise 'Continue'
+	 * is returned without yielding.
+	 * Must not be called from an interrupt handler.
+	 */
+	[[nodiscard]]
+	YieldResult set();
+
+private:
+	friend WaitResult detail::wait_for(Coroutine&, Event* const*, uint8_t, bool);
+
+	/** Wait descriptor of the coroutine waiting on this event, if any. */
+	detail::WaitList* waiter_ = nullptr;
+	bool set_ = false;
+};
+
+/**
+ * Suspend the currently-running coroutine, yielding to 'next', until any
+ * of the given events is set.  Returns immediately if one is already set.
+ * The event that fired is cleared and its position is reported in the result.
+ */
+template <class ... Events>
+[[nodiscard]]
+WaitResult wait_any(Coroutine& next, Event& first, Events& ... rest) {
+	static_assert((traits::is_same_v<Event, Events> and ...), "wait_any() only accepts Event objects.");
+	static_assert(sizeof...(Events) < WaitResult::none, "Too many events passed to wait_any().");
+	Event* const events[] = {&first, &rest ...};
+	return detail::wait_for(next, events, 1u + sizeof...(Events), false);
+}
+
+/**
+ * Suspend the currently-running coroutine, yielding to 'next', until all
+ * of the given events are set.  Returns immediately if all are already set.
+ * All events are cleared and the position of the one whose 'set()' completed
+ * the wait is reported in the result (the last argument's position if all
+ * of them were already set on entry).
+ */
+template <class ... Events>
+[[nodiscard]]
+WaitResult wait_all(Coroutine& next, Event& first, Events& ... rest) {
+	static_assert((traits::is_same_v<Event, Events> and ...), "wait_all() only accepts Event objects.");
+	static_assert(sizeof...(Events) < WaitResult::none, "Too many events passed to wait_all().");
+	Event* const events[] = {&first, &rest ...};
+	return detail::wait_for(next, events, 1u + sizeof...(Events), true);
+}
+
 } /* namespace tim::coro */
 
 #endif /* INO_CORO_COROUTINE_H */
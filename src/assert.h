@@ -33,7 +33,7 @@ inline void assert_fail(const char* assertion, const char* file, long linenumber
 } /* namespace tim::detail */
 
 #ifndef assert
-# ifdef defined(NDEBUG) || defined(TIM_CORO_NO_ASSERT)
+# if defined(NDEBUG) || defined(TIM_CORO_NO_ASSERT)
 #  define assert(x) (void)(x)
 # else
 #  define assert(x) \
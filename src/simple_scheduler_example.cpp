@@ -63,14 +63,12 @@ struct RoundRobinScheduler {
 
 	/** Terminate all remaining tasks. */
 	void end() {
-		size_t i = 0u;
-		for(auto* coro: tasks_) {
+		for(auto*& coro: tasks_) {
 			if(not coro) {
 				return;
 			}
 			terminate(*coro);
-			remove_task(i);
-			++i;
+			coro = nullptr;
 		}
 	}
 
@@ -112,6 +110,7 @@ private:
 				break;
 			}
 			tasks_[i - 1u] = tasks_[i];
+			tasks_[i] = nullptr;
 		}
 	}
 
@@ -0,0 +1,34 @@
+/**
+ * Copyright 2019 Timothy J. VanSlyke
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * Compiled (but never linked) by the 'size-report' target.  Each array below
+ * is exactly as large as the per-object RAM cost it is named after, so the
+ * costs can be read back from the object file with 'avr-nm -S'.
+ */
+
+#include "Coroutine.h"
+
+using namespace tim::coro;
+
+// Smallest possible BasicCoroutine: function pointer callable, 1-byte stack.
+using ProbeCoroutine = BasicCoroutine<void (*)(Coroutine&), 1u>;
+
+extern "C" {
+
+// Bookkeeping shared by every coroutine.
+char tim_coro_sizeof_Coroutine[sizeof(Coroutine)];
+// Per-coroutine RAM used by a BasicCoroutine beyond its stack (includes the callable).
+char tim_coro_sizeof_BasicCoroutine_overhead[sizeof(ProbeCoroutine) - 1u];
+char tim_coro_sizeof_Event[sizeof(Event)];
+// A TaskGroup costs this plus one pointer per member.
+char tim_coro_sizeof_TaskGroup_base[sizeof(TaskGroup<1u>) - sizeof(Coroutine*)];
+
+}
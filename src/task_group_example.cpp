@@ -0,0 +1,73 @@
+/**
+ * Copyright 2019 Timothy J. VanSlyke
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Coroutine.h"
+#include <stdio.h>
+
+using namespace tim::coro;
+
+// Globals are bad, but this is an example.
+static Event sensor_ready;
+static Event motor_idle;
+
+// Worker coroutines that each wait for one event and then finish.
+static void read_sensor(Coroutine& self) {
+	if(wait_any(Coroutine::main, sensor_ready).signal == YieldResult::Terminate) {
+		printf("sensor: cancelled\n");
+		return;
+	}
+	printf("sensor: done\n");
+}
+static void drive_motor(Coroutine& self) {
+	if(wait_any(Coroutine::main, motor_idle).signal == YieldResult::Terminate) {
+		printf("motor: cancelled\n");
+		return;
+	}
+	printf("motor: done\n");
+}
+// Actual coroutine objects and the group that owns them.
+static auto sensor = BasicCoroutine{read_sensor};
+static auto motor = BasicCoroutine{drive_motor};
+static auto workers = TaskGroup{sensor, motor};
+
+// Supervisor coroutine that sleeps until the whole group has finished.
+static void supervise(Coroutine& self) {
+	for(;;) {
+		if(workers.join(Coroutine::main) == YieldResult::Terminate) {
+			return;
+		}
+		printf("supervisor: all workers finished\n");
+		if(yield_to(Coroutine::main) == YieldResult::Terminate) {
+			return;
+		}
+	}
+}
+static auto supervisor = BasicCoroutine{supervise};
+
+// Run every worker and the supervisor until they block.
+static void start_mode() {
+	workers.begin();
+	(void)yield_to(sensor);
+	(void)yield_to(motor);
+	(void)yield_to(supervisor);
+}
+
+int main() {
+	supervisor.begin();
+	start_mode();
+	// The supervisor is resumed only once, by the last worker to finish.
+	(void)sensor_ready.set();
+	(void)motor_idle.set();
+	// Mode change: respawn the group, then tear it down in one pass.
+	start_mode();
+	workers.cancel();
+	printf("main: %d workers left\n", static_cast<int>(workers.live()));
+	supervisor.end();
+}
@@ -0,0 +1,67 @@
+/**
+ * Copyright 2019 Timothy J. VanSlyke
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Coroutine.h"
+#include <stdio.h>
+
+using namespace tim::coro;
+
+// Globals are bad, but this is an example.
+static Event byte_received;
+static Event timed_out;
+static Event stop_requested;
+static volatile char last_byte = '\0';
+
+// Reader coroutine that blocks on "byte OR timeout OR stop" with a single wait.
+static void read_bytes(Coroutine& self) {
+	for(;;) {
+		auto res = wait_any(Coroutine::main, byte_received, timed_out, stop_requested);
+		if(res.signal == YieldResult::Terminate) {
+			printf("reader: terminated while waiting\n");
+			return;
+		}
+		switch(res.index) {
+		case 0u:
+			printf("reader: got '%c'\n", last_byte);
+			break;
+		case 1u:
+			printf("reader: timed out\n");
+			break;
+		case 2u:
+		default:
+			printf("reader: stop requested\n");
+			return;
+		}
+	}
+}
+// Actual coroutine object.
+static auto reader = BasicCoroutine{read_bytes};
+
+int main() {
+	reader.begin();
+	// Run the reader until it blocks in wait_any().
+	(void)yield_to(reader);
+	// Each set() resumes the reader directly; it yields back to main when it
+	// blocks again.  An interrupt handler would set a flag that main forwards.
+	for(const char* s = "hi"; *s; ++s) {
+		last_byte = *s;
+		(void)byte_received.set();
+	}
+	(void)timed_out.set();
+	// Ending the reader while it waits delivers 'Terminate' out of wait_any().
+	reader.end();
+	printf("main: reader done = %d\n", static_cast<int>(reader.is_done()));
+	// Restart the reader and stop it cleanly this time.
+	reader.begin();
+	(void)yield_to(reader);
+	if(stop_requested.set() == YieldResult::Terminated) {
+		printf("main: reader stopped\n");
+	}
+}